@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/addba-extension.h"
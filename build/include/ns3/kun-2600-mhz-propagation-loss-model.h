@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/kun-2600-mhz-propagation-loss-model.h"
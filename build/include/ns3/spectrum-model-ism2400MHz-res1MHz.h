@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/spectrum-model-ism2400MHz-res1MHz.h"
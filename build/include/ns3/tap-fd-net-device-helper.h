@@ -0,0 +1 @@
+#include "/root/repo/src/fd-net-device/helper/tap-fd-net-device-helper.h"
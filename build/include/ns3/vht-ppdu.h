@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/vht/vht-ppdu.h"
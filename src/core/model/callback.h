@@ -263,7 +263,8 @@ class CallbackImpl : public CallbackImplBase
      */
     R operator()(UArgs... uargs) const
     {
-        return m_func(uargs...);
+        // arguments taken by value are moved, not copied, into the function
+        return m_func(std::forward<UArgs>(uargs)...);
     }
 
     bool IsEqual(Ptr<const CallbackImplBase> other) const override
@@ -571,7 +572,7 @@ class Callback : public CallbackBase
      */
     R operator()(UArgs... uargs) const
     {
-        return (*(DoPeekImpl()))(uargs...);
+        return (*(DoPeekImpl()))(std::forward<UArgs>(uargs)...);
     }
 
     /**
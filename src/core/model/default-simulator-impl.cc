@@ -51,7 +51,7 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
     m_eventCount = 0;
-    m_eventsWithContextEmpty = true;
+    m_eventsWithContext = nullptr;
     m_mainThreadId = std::this_thread::get_id();
 }
 
@@ -145,30 +145,34 @@ DefaultSimulatorImpl::IsFinished() const
 void
 DefaultSimulatorImpl::ProcessEventsWithContext()
 {
-    if (m_eventsWithContextEmpty)
+    if (m_eventsWithContext.load(std::memory_order_relaxed) == nullptr)
     {
         return;
     }
 
-    // swap queues
-    EventsWithContext eventsWithContext;
+    // detach the queue, and reverse it to get the events in insertion order
+    EventWithContext* head = m_eventsWithContext.exchange(nullptr, std::memory_order_acquire);
+    EventWithContext* eventsWithContext = nullptr;
+    while (head != nullptr)
     {
-        std::unique_lock lock{m_eventsWithContextMutex};
-        m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
+        EventWithContext* next = head->next;
+        head->next = eventsWithContext;
+        eventsWithContext = head;
+        head = next;
     }
-    while (!eventsWithContext.empty())
+    while (eventsWithContext != nullptr)
     {
-        EventWithContext event = eventsWithContext.front();
-        eventsWithContext.pop_front();
+        EventWithContext* event = eventsWithContext;
+        eventsWithContext = event->next;
         Scheduler::Event ev;
-        ev.impl = event.event;
-        ev.key.m_ts = m_currentTs + event.timestamp;
-        ev.key.m_context = event.context;
+        ev.impl = event->event;
+        ev.key.m_ts = m_currentTs + event->timestamp;
+        ev.key.m_context = event->context;
         ev.key.m_uid = m_uid;
         m_uid++;
         m_unscheduledEvents++;
         m_events->Insert(ev);
+        delete event;
     }
 }
 
@@ -248,19 +252,45 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
     }
     else
     {
-        EventWithContext ev;
-        ev.context = context;
+        auto ev = new EventWithContext;
+        ev->context = context;
         // Current time added in ProcessEventsWithContext()
-        ev.timestamp = delay.GetTimeStep();
-        ev.event = event;
+        ev->timestamp = delay.GetTimeStep();
+        ev->event = event;
+        ev->next = m_eventsWithContext.load(std::memory_order_relaxed);
+        while (!m_eventsWithContext.compare_exchange_weak(ev->next,
+                                                          ev,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed))
         {
-            std::unique_lock lock{m_eventsWithContextMutex};
-            m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
         }
     }
 }
 
+void
+DefaultSimulatorImpl::ScheduleBatchWithContext(const Time& delay, const EventBatch& events)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep() << events.size());
+
+    if (events.size() < 2 || m_mainThreadId != std::this_thread::get_id())
+    {
+        // Nothing to gain from a batch entry; other threads go through
+        // the regular events-with-context path.
+        SimulatorImpl::ScheduleBatchWithContext(delay, events);
+        return;
+    }
+
+    Time tAbsolute = delay + TimeStep(m_currentTs);
+    Scheduler::Event ev;
+    ev.impl = new BatchEventImpl(this, events);
+    ev.key.m_ts = (uint64_t)tAbsolute.GetTimeStep();
+    ev.key.m_context = events.front().first;
+    ev.key.m_uid = m_uid;
+    m_uid += events.size();
+    m_unscheduledEvents++;
+    m_events->Insert(ev);
+}
+
 EventId
 DefaultSimulatorImpl::ScheduleNow(EventImpl* event)
 {
@@ -386,4 +416,58 @@ DefaultSimulatorImpl::GetEventCount() const
     return m_eventCount;
 }
 
+DefaultSimulatorImpl::BatchEventImpl::BatchEventImpl(DefaultSimulatorImpl* simulator,
+                                                     const EventBatch& events)
+    : m_simulator(simulator),
+      m_events(events),
+      m_next(0)
+{
+}
+
+DefaultSimulatorImpl::BatchEventImpl::~BatchEventImpl()
+{
+    for (; m_next < m_events.size(); ++m_next)
+    {
+        m_events[m_next].second->Unref();
+    }
+}
+
+void
+DefaultSimulatorImpl::BatchEventImpl::Notify()
+{
+    // The first event of the batch has already been accounted for
+    // by ProcessOneEvent(), which set the current uid to the batch uid.
+    const uint32_t firstUid = m_simulator->m_currentUid - m_next;
+    while (m_next < m_events.size())
+    {
+        auto [context, event] = m_events[m_next];
+        uint32_t uid = firstUid + m_next;
+        if (uid != m_simulator->m_currentUid)
+        {
+            m_simulator->PreEventHook(EventId(event, m_simulator->m_currentTs, context, uid));
+            m_simulator->m_eventCount++;
+            m_simulator->m_currentUid = uid;
+        }
+        m_simulator->m_currentContext = context;
+        ++m_next;
+        event->Invoke();
+        event->Unref();
+
+        if (m_simulator->m_stop && m_next < m_events.size())
+        {
+            // Leave the remaining events in the event list, keyed by the
+            // uid of the next one, so that they run if Run() is called again.
+            Scheduler::Event ev;
+            ev.impl = this;
+            ev.key.m_ts = m_simulator->m_currentTs;
+            ev.key.m_context = m_events[m_next].first;
+            ev.key.m_uid = firstUid + m_next;
+            Ref();
+            m_simulator->m_unscheduledEvents++;
+            m_simulator->m_events->Insert(ev);
+            return;
+        }
+    }
+}
+
 } // namespace ns3
@@ -11,8 +11,8 @@
 
 #include "simulator-impl.h"
 
+#include <atomic>
 #include <list>
-#include <mutex>
 #include <thread>
 
 /**
@@ -53,6 +53,7 @@ class DefaultSimulatorImpl : public SimulatorImpl
     EventId Stop(const Time& delay) override;
     EventId Schedule(const Time& delay, EventImpl* event) override;
     void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    void ScheduleBatchWithContext(const Time& delay, const EventBatch& events) override;
     EventId ScheduleNow(EventImpl* event) override;
     EventId ScheduleDestroy(EventImpl* event) override;
     void Remove(const EventId& id) override;
@@ -75,6 +76,40 @@ class DefaultSimulatorImpl : public SimulatorImpl
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
 
+    /**
+     * A single event list entry which executes, in order, a batch of
+     * events sharing the same timestamp.
+     *
+     * The batch is assigned a contiguous range of event uids, the
+     * first of which is used as its key in the event list.  Each event
+     * of the batch is executed with its own context and uid, so that the
+     * execution order and the simulator state observed by the events are
+     * the same as if they had been scheduled one by one.
+     */
+    class BatchEventImpl : public EventImpl
+    {
+      public:
+        /**
+         * Constructor.
+         * @param [in] simulator The simulator executing the batch.
+         * @param [in] events The events of the batch.
+         */
+        BatchEventImpl(DefaultSimulatorImpl* simulator, const EventBatch& events);
+        /** Destructor: releases the events which have not been executed. */
+        ~BatchEventImpl() override;
+
+      protected:
+        void Notify() override;
+
+      private:
+        /** The simulator executing the batch. */
+        DefaultSimulatorImpl* m_simulator;
+        /** The events of the batch. */
+        EventBatch m_events;
+        /** Index of the next event of the batch to execute. */
+        std::size_t m_next;
+    };
+
     /** Wrap an event with its execution context. */
     struct EventWithContext
     {
@@ -84,19 +119,19 @@ class DefaultSimulatorImpl : public SimulatorImpl
         uint64_t timestamp;
         /** The event implementation. */
         EventImpl* event;
+        /** The event queued just before this one. */
+        EventWithContext* next;
     };
 
-    /** Container type for the events from a different context. */
-    typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
     /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
+     * The events from a different context.
+     *
+     * This is a lock-free multiple producer, single consumer queue:
+     * other threads push new events at the head with a compare-and-swap,
+     * and the main thread detaches the whole list at once with an
+     * atomic exchange, then reverses it to recover the insertion order.
      */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
-    std::mutex m_eventsWithContextMutex;
+    std::atomic<EventWithContext*> m_eventsWithContext;
 
     /** Container type for the events to run at Simulator::Destroy() */
     typedef std::list<EventId> DestroyEvents;
@@ -11,6 +11,8 @@
 #include "simple-ref-count.h"
 
 #include <stdint.h>
+#include <utility>
+#include <vector>
 
 /**
  * @file
@@ -69,6 +71,15 @@ class EventImpl : public SimpleRefCount<EventImpl>
     bool m_cancel; /**< Has this event been cancelled. */
 };
 
+/**
+ * @ingroup events
+ * A batch of events sharing the same expiration time.
+ *
+ * Each entry pairs the execution context of an event with its
+ * implementation. Entries are executed in the order of the container.
+ */
+typedef std::vector<std::pair<uint32_t, EventImpl*>> EventBatch;
+
 } // namespace ns3
 
 #endif /* EVENT_IMPL_H */
@@ -13,6 +13,7 @@
  */
 #include "random-variable-stream.h"
 
+#include "abort.h"
 #include "assert.h"
 #include "boolean.h"
 #include "double.h"
@@ -28,6 +29,8 @@
 #include <cmath>
 #include <iostream>
 #include <numbers>
+#include <set>
+#include <sstream>
 
 /**
  * @file
@@ -42,6 +45,22 @@ NS_LOG_COMPONENT_DEFINE("RandomVariableStream");
 
 NS_OBJECT_ENSURE_REGISTERED(RandomVariableStream);
 
+/**
+ * @ingroup randomvariable
+ * Get the set of all the existing random variable streams.
+ *
+ * The set is deliberately never deleted, so that streams held by
+ * static objects can still unregister during static destruction.
+ *
+ * @returns The existing streams.
+ */
+static std::set<RandomVariableStream*>&
+GetAllStreams()
+{
+    static auto streams = new std::set<RandomVariableStream*>;
+    return *streams;
+}
+
 TypeId
 RandomVariableStream::GetTypeId()
 {
@@ -63,18 +82,30 @@ RandomVariableStream::GetTypeId()
                                           BooleanValue(false),
                                           MakeBooleanAccessor(&RandomVariableStream::SetAntithetic,
                                                               &RandomVariableStream::IsAntithetic),
-                                          MakeBooleanChecker());
+                                          MakeBooleanChecker())
+                            .AddAttribute("RngState",
+                                          "The current position of this RNG stream, as the six "
+                                          "components of the MRG32k3a state vector. An empty "
+                                          "string leaves the position unchanged. This must be "
+                                          "set after the Stream attribute.",
+                                          StringValue(""),
+                                          MakeStringAccessor(&RandomVariableStream::SetRngState,
+                                                             &RandomVariableStream::GetRngState),
+                                          MakeStringChecker());
     return tid;
 }
 
 RandomVariableStream::RandomVariableStream()
-    : m_rng(nullptr)
+    : m_rng(nullptr),
+      m_rngStream(0)
 {
     NS_LOG_FUNCTION(this);
+    GetAllStreams().insert(this);
 }
 
 RandomVariableStream::~RandomVariableStream()
 {
+    GetAllStreams().erase(this);
     delete m_rng;
 }
 
@@ -115,6 +146,7 @@ RandomVariableStream::SetStream(int64_t stream)
         NS_ASSERT(nextStream <= ((1ULL) << 63));
         NS_LOG_INFO(GetInstanceTypeId().GetName() << " automatic stream: " << nextStream);
         m_rng = new RngStream(RngSeedManager::GetSeed(), nextStream, RngSeedManager::GetRun());
+        m_rngStream = nextStream;
     }
     else
     {
@@ -124,6 +156,7 @@ RandomVariableStream::SetStream(int64_t stream)
         uint64_t target = base + stream;
         NS_LOG_INFO(GetInstanceTypeId().GetName() << " configured stream: " << stream);
         m_rng = new RngStream(RngSeedManager::GetSeed(), target, RngSeedManager::GetRun());
+        m_rngStream = target;
     }
     m_stream = stream;
 }
@@ -134,6 +167,56 @@ RandomVariableStream::GetStream() const
     return m_stream;
 }
 
+std::string
+RandomVariableStream::GetRngState() const
+{
+    double state[6];
+    m_rng->GetState(state);
+    std::ostringstream oss;
+    for (int i = 0; i < 6; ++i)
+    {
+        oss << (i == 0 ? "" : " ") << static_cast<uint64_t>(state[i]);
+    }
+    return oss.str();
+}
+
+void
+RandomVariableStream::SetRngState(std::string state)
+{
+    NS_LOG_FUNCTION(this << state);
+    if (state.empty())
+    {
+        return;
+    }
+    double values[6];
+    std::istringstream iss(state);
+    for (int i = 0; i < 6; ++i)
+    {
+        uint64_t value;
+        iss >> value;
+        NS_ABORT_MSG_IF(iss.fail(), "Ill-formed RngState: \"" << state << "\"");
+        values[i] = static_cast<double>(value);
+    }
+    m_rng->SetState(values);
+}
+
+void
+RandomVariableStream::ReseedAll()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    for (auto stream : GetAllStreams())
+    {
+        if (stream->m_rng == nullptr)
+        {
+            continue;
+        }
+        delete stream->m_rng;
+        stream->m_rng = new RngStream(RngSeedManager::GetSeed(),
+                                      stream->m_rngStream,
+                                      RngSeedManager::GetRun());
+    }
+}
+
 RngStream*
 RandomVariableStream::Peek() const
 {
@@ -21,6 +21,7 @@
 
 #include <map>
 #include <stdint.h>
+#include <string>
 
 /**
  * @file
@@ -133,6 +134,37 @@ class RandomVariableStream : public Object
      */
     bool IsAntithetic() const;
 
+    /**
+     * @brief Get the current position of the underlying RngStream.
+     *
+     * The position is formatted as the six integer components of the
+     * MRG32k3a state vector, separated by spaces.  It is exposed as the
+     * \c RngState attribute, so that ConfigStore can save the position
+     * of every stream reachable through the attribute system and restore
+     * it in a later run.
+     *
+     * @return The state of the underlying RngStream.
+     */
+    std::string GetRngState() const;
+    /**
+     * @brief Move the underlying RngStream to a saved position.
+     *
+     * An empty string leaves the stream unchanged.
+     *
+     * @param [in] state A state previously returned by GetRngState().
+     */
+    void SetRngState(std::string state);
+
+    /**
+     * @brief Restart every existing stream from the current seed and run.
+     *
+     * Each stream keeps its stream number, and is moved to the start of
+     * the substream selected by RngSeedManager::GetRun().  This is used
+     * to make replicas of an already configured simulation statistically
+     * independent, see Simulator::ForkReplicas().
+     */
+    static void ReseedAll();
+
     /**
      * @brief Get the next random value drawn from the distribution.
      * @return A random value.
@@ -160,6 +192,9 @@ class RandomVariableStream : public Object
     /** The stream number for the RngStream. */
     int64_t m_stream;
 
+    /** The index of the underlying RngStream, including automatic assignment. */
+    uint64_t m_rngStream;
+
 }; // class RandomVariableStream
 
 /**
@@ -386,6 +386,24 @@ RngStream::RngStream(const RngStream& r)
     }
 }
 
+void
+RngStream::GetState(double state[6]) const
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        state[i] = m_currentState[i];
+    }
+}
+
+void
+RngStream::SetState(const double state[6])
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        m_currentState[i] = state[i];
+    }
+}
+
 void
 RngStream::AdvanceNthBy(uint64_t nth, int by, double state[6])
 {
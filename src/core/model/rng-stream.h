@@ -60,6 +60,22 @@ class RngStream
      */
     double RandU01();
 
+    /**
+     * Get the current position of this stream.
+     *
+     * Together with SetState(), this allows a stream to be checkpointed
+     * and later resumed from the same position.
+     *
+     * @param [out] state The RNG state vector.
+     */
+    void GetState(double state[6]) const;
+    /**
+     * Move this stream to a position previously returned by GetState().
+     *
+     * @param [in] state The RNG state vector.
+     */
+    void SetState(const double state[6]);
+
   private:
     /**
      * Advance \pname{state} of the RNG by leaps and bounds.
@@ -29,4 +29,14 @@ SimulatorImpl::GetTypeId()
     return tid;
 }
 
+void
+SimulatorImpl::ScheduleBatchWithContext(const Time& delay, const EventBatch& events)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep() << events.size());
+    for (const auto& [context, event] : events)
+    {
+        ScheduleWithContext(context, delay, event);
+    }
+}
+
 } // namespace ns3
@@ -55,6 +55,13 @@ class SimulatorImpl : public Object
     virtual EventId Schedule(const Time& delay, EventImpl* event) = 0;
     /** @copydoc Simulator::ScheduleWithContext(uint32_t,const Time&,EventImpl*) */
     virtual void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) = 0;
+    /**
+     * @copydoc Simulator::ScheduleBatchWithContext
+     *
+     * The default implementation simply calls ScheduleWithContext()
+     * for each event of the batch.
+     */
+    virtual void ScheduleBatchWithContext(const Time& delay, const EventBatch& events);
     /** @copydoc Simulator::ScheduleNow(const Ptr<EventImpl>&) */
     virtual EventId ScheduleNow(EventImpl* event) = 0;
     /** @copydoc Simulator::ScheduleDestroy(const Ptr<EventImpl>&) */
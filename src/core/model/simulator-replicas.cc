@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "abort.h"
+#include "fatal-error.h"
+#include "log.h"
+#include "random-variable-stream.h"
+#include "rng-seed-manager.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifndef __WIN32__
+#include <cerrno>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::Simulator replica management, implemented with fork().
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SimulatorReplicas");
+
+/**
+ * @ingroup simulator
+ * Write end of the pipe on which a replica reports its result,
+ * or -1 outside of a replica.
+ */
+static int g_replicaFd = -1;
+
+/**
+ * @ingroup simulator
+ * The results of the replicas of the last call to Simulator::ForkReplicas().
+ */
+static std::vector<std::string> g_replicaResults;
+
+/**
+ * @ingroup simulator
+ * Flush the standard streams, so that buffered output is not
+ * duplicated in forked processes.
+ */
+static void
+FlushStandardStreams()
+{
+    std::cout.flush();
+    std::cerr.flush();
+    std::clog.flush();
+    std::fflush(nullptr);
+}
+
+uint32_t
+Simulator::ForkReplicas(uint32_t n, uint32_t maxConcurrent)
+{
+    NS_LOG_FUNCTION(n << maxConcurrent);
+#ifdef __WIN32__
+    NS_FATAL_ERROR("Simulator::ForkReplicas is not supported on this platform");
+#else
+    NS_ABORT_MSG_IF(g_replicaFd != -1, "A replica cannot fork replicas");
+    if (maxConcurrent == 0)
+    {
+        maxConcurrent = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    /// A running replica, seen from the calling process.
+    struct Replica
+    {
+        pid_t pid;      //!< The replica process id.
+        int fd;         //!< Read end of the result pipe.
+        uint32_t index; //!< The replica index.
+    };
+
+    std::vector<Replica> running;
+    g_replicaResults.assign(n, "");
+    const uint64_t baseRun = RngSeedManager::GetRun();
+    uint32_t next = 1;
+    while (next <= n || !running.empty())
+    {
+        while (next <= n && running.size() < maxConcurrent)
+        {
+            int fds[2];
+            NS_ABORT_MSG_IF(pipe(fds) == -1, "pipe() failed: " << std::strerror(errno));
+            FlushStandardStreams();
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid == -1, "fork() failed: " << std::strerror(errno));
+            if (pid == 0)
+            {
+                close(fds[0]);
+                for (const auto& replica : running)
+                {
+                    close(replica.fd);
+                }
+                g_replicaFd = fds[1];
+                g_replicaResults.clear();
+                RngSeedManager::SetRun(baseRun + next - 1);
+                RandomVariableStream::ReseedAll();
+                return next;
+            }
+            NS_LOG_LOGIC("forked replica " << next << " as process " << pid);
+            close(fds[1]);
+            running.push_back({pid, fds[0], next});
+            next++;
+        }
+
+        std::vector<pollfd> pollFds;
+        for (const auto& replica : running)
+        {
+            pollFds.push_back({replica.fd, POLLIN, 0});
+        }
+        if (poll(pollFds.data(), pollFds.size(), -1) == -1)
+        {
+            NS_ABORT_MSG_IF(errno != EINTR, "poll() failed: " << std::strerror(errno));
+            continue;
+        }
+        for (std::size_t i = pollFds.size(); i-- > 0;)
+        {
+            if (pollFds[i].revents == 0)
+            {
+                continue;
+            }
+            Replica replica = running[i];
+            char buffer[4096];
+            ssize_t len = read(replica.fd, buffer, sizeof(buffer));
+            if (len > 0)
+            {
+                g_replicaResults[replica.index - 1].append(buffer, len);
+                continue;
+            }
+            if (len == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            // end of file: the replica has exited, or is about to
+            close(replica.fd);
+            int status;
+            while (waitpid(replica.pid, &status, 0) == -1 && errno == EINTR)
+            {
+            }
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+            {
+                NS_LOG_WARN("replica " << replica.index << " did not exit successfully");
+            }
+            running.erase(running.begin() + i);
+        }
+    }
+    return 0;
+#endif
+}
+
+void
+Simulator::ExitReplica(const std::string& result)
+{
+    NS_LOG_FUNCTION(result.size());
+#ifdef __WIN32__
+    NS_FATAL_ERROR("Simulator::ExitReplica is not supported on this platform");
+#else
+    NS_ABORT_MSG_IF(g_replicaFd == -1, "Simulator::ExitReplica called outside of a replica");
+    const char* data = result.data();
+    std::size_t left = result.size();
+    while (left > 0)
+    {
+        ssize_t written = write(g_replicaFd, data, left);
+        if (written == -1)
+        {
+            NS_ABORT_MSG_IF(errno != EINTR, "write() failed: " << std::strerror(errno));
+            continue;
+        }
+        data += written;
+        left -= written;
+    }
+    close(g_replicaFd);
+    g_replicaFd = -1;
+    FlushStandardStreams();
+    // Static objects belong to the calling process: do not destroy them here
+    _exit(EXIT_SUCCESS);
+#endif
+}
+
+std::vector<std::string>
+Simulator::GetReplicaResults()
+{
+    return g_replicaResults;
+}
+
+} // namespace ns3
@@ -230,6 +230,18 @@ Simulator::ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* i
     return GetImpl()->ScheduleWithContext(context, delay, impl);
 }
 
+void
+Simulator::ScheduleBatchWithContext(const Time& delay, const EventBatch& events)
+{
+#ifdef ENABLE_DES_METRICS
+    for (const auto& entry : events)
+    {
+        DesMetrics::Get()->TraceWithContext(entry.first, Now(), delay);
+    }
+#endif
+    GetImpl()->ScheduleBatchWithContext(delay, events);
+}
+
 EventId
 Simulator::ScheduleDestroy(const Ptr<EventImpl>& ev)
 {
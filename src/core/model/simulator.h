@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 /**
  * @file
@@ -205,6 +206,60 @@ class Simulator
      */
     static uint64_t GetEventCount();
 
+    /**
+     * @name Replicate an already configured simulation.
+     */
+    /** @{ */
+    /**
+     * Fork independent replicas of the simulation.
+     *
+     * This is meant to be called once the scenario has been built,
+     * but before Simulator::Run().  The process is forked @p n times,
+     * so that the replicas share the memory pages of the configured
+     * topology copy-on-write instead of building it again.  Replica
+     * @c i uses the run number RngSeedManager::GetRun() + i - 1, and all
+     * the existing random variable streams are reseeded accordingly
+     * (see RandomVariableStream::ReseedAll()).
+     *
+     * Each replica should run the simulation, then report its result
+     * with ExitReplica(), which terminates the replica process.  The
+     * calling process only returns from this method once all the
+     * replicas have exited, and can then collect their results with
+     * GetReplicaResults().
+     *
+     * This method is only available on POSIX systems.
+     *
+     * @param [in] n The number of replicas.
+     * @param [in] maxConcurrent The maximum number of replicas running at
+     *             the same time, or 0 to use the number of hardware threads.
+     * @returns The replica index, in [1, n], in each replica, and 0 in the
+     *          calling process once all the replicas have exited.
+     */
+    static uint32_t ForkReplicas(uint32_t n, uint32_t maxConcurrent = 0);
+
+    /**
+     * Report the result of a replica to the process which forked it,
+     * and terminate the replica.
+     *
+     * Static objects are not destroyed when the replica terminates, so
+     * Simulator::Destroy() should be called beforehand to flush the
+     * outputs of the replica.
+     *
+     * @param [in] result The result of this replica.
+     */
+    [[noreturn]] static void ExitReplica(const std::string& result);
+
+    /**
+     * Get the results reported by the replicas of the last call
+     * to ForkReplicas().
+     *
+     * @returns The result of each replica, indexed by replica index - 1.
+     *          The result of a replica which exited without calling
+     *          ExitReplica() is empty.
+     */
+    static std::vector<std::string> GetReplicaResults();
+    /** @} */
+
     /**
      * @name Schedule events (in the same context) to run at a future time.
      */
@@ -470,6 +525,25 @@ class Simulator
      */
     static void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event);
 
+    /**
+     * Schedule a batch of events which expire at the same time,
+     * each in its own context.
+     * This method is thread-safe: it can be called from any thread.
+     *
+     * The events are executed in the order in which they appear in
+     * the batch, exactly as if ScheduleWithContext() had been called
+     * for each of them in turn.  Simulator implementations which
+     * support it store the whole batch as a single entry of the event
+     * list, so that a fan-out to N receivers costs one Scheduler
+     * insertion and removal instead of N.
+     *
+     * The simulator takes ownership of the events in the batch.
+     *
+     * @param [in] delay The relative expiration time of the events.
+     * @param [in] events The (context, event) pairs to schedule.
+     */
+    static void ScheduleBatchWithContext(const Time& delay, const EventBatch& events);
+
     /**
      * Schedule an event to run at the end of the simulation, after
      * the Stop() time or condition has been reached.
@@ -75,10 +75,15 @@ class TracedCallback
     void Disconnect(const CallbackBase& callback, std::string path);
     /**
      * @brief Functor which invokes the chain of Callbacks.
+     *
+     * The arguments are taken by reference, so that a trace source
+     * without any connected sink costs a single test, and no copy
+     * of its arguments.
+     *
      * @tparam Ts \deduced Types of the functor arguments.
      * @param [in] args The arguments to the functor
      */
-    void operator()(Ts... args) const;
+    void operator()(const Ts&... args) const;
     /**
      * @brief Checks if the Callbacks list is empty.
      * @return true if the Callbacks list is empty.
@@ -179,8 +184,12 @@ TracedCallback<Ts...>::Disconnect(const CallbackBase& callback, std::string path
 
 template <typename... Ts>
 void
-TracedCallback<Ts...>::operator()(Ts... args) const
+TracedCallback<Ts...>::operator()(const Ts&... args) const
 {
+    if (m_callbackList.empty())
+    {
+        return;
+    }
     for (auto i = m_callbackList.begin(); i != m_callbackList.end(); i++)
     {
         (*i)(args...);
@@ -27,6 +27,7 @@
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_sf_zeta.h>
+#include <vector>
 
 using namespace ns3;
 
@@ -2951,6 +2952,60 @@ ShuffleElementsTest::DoRun()
                           "Expected vector {4, 1, 9, 3, 2, 7}");
 }
 
+/**
+ * @ingroup rng-tests
+ * Test case for saving and restoring the position of a random variable stream
+ */
+class RngStateTestCase : public TestCase
+{
+  public:
+    RngStateTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+RngStateTestCase::RngStateTestCase()
+    : TestCase("Check that the RngState attribute restores the stream position")
+{
+}
+
+void
+RngStateTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    auto rv = CreateObject<UniformRandomVariable>();
+    rv->SetStream(1);
+    for (int i = 0; i < 10; i++)
+    {
+        rv->GetValue();
+    }
+
+    StringValue state;
+    rv->GetAttribute("RngState", state);
+    std::vector<double> expected;
+    for (int i = 0; i < 10; i++)
+    {
+        expected.push_back(rv->GetValue());
+    }
+
+    // A stream with the same configuration resumes from the saved position
+    auto other = CreateObject<UniformRandomVariable>();
+    other->SetAttribute("Stream", IntegerValue(1));
+    other->SetAttribute("RngState", state);
+    // An empty state leaves the position unchanged
+    other->SetAttribute("RngState", StringValue(""));
+    for (int i = 0; i < 10; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(other->GetValue(), expected[i], "Wrong value after restore");
+    }
+
+    rv->SetRngState(state.Get());
+    NS_TEST_EXPECT_MSG_EQ(rv->GetValue(), expected[0], "Wrong value after rewind");
+}
+
 /**
  * @ingroup rng-tests
  * Test case for laplacian distribution random variable stream generator
@@ -3144,6 +3199,7 @@ RandomVariableSuite::RandomVariableSuite()
     AddTestCase(new BinomialTestCase);
     AddTestCase(new BinomialAntitheticTestCase);
     AddTestCase(new ShuffleElementsTest);
+    AddTestCase(new RngStateTestCase);
     AddTestCase(new LaplacianTestCase);
     AddTestCase(new LargestExtremeValueTestCase);
 }
@@ -10,9 +10,14 @@
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -200,6 +205,141 @@ SimulatorEventsTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(m_destroy, true, "Event should have run");
 }
 
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that batches of events sharing one timestamp are executed in order.
+ */
+class SimulatorBatchTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param schedulerFactory Scheduler factory.
+     */
+    SimulatorBatchTestCase(ObjectFactory schedulerFactory);
+    void DoRun() override;
+
+  private:
+    /**
+     * Record the execution of an event.
+     * @param value Event identifier.
+     */
+    void Record(int value);
+
+    std::vector<int> m_values;        //!< Identifiers of the executed events.
+    std::vector<uint32_t> m_contexts; //!< Contexts of the executed events.
+    std::vector<Time> m_times;        //!< Execution times of the events.
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SimulatorBatchTestCase::SimulatorBatchTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check that batched events are executed in order with " +
+               schedulerFactory.GetTypeId().GetName()),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SimulatorBatchTestCase::Record(int value)
+{
+    m_values.push_back(value);
+    m_contexts.push_back(Simulator::GetContext());
+    m_times.push_back(Simulator::Now());
+}
+
+void
+SimulatorBatchTestCase::DoRun()
+{
+    Simulator::SetScheduler(m_schedulerFactory);
+
+    Simulator::ScheduleWithContext(7, MicroSeconds(10), &SimulatorBatchTestCase::Record, this, 0);
+    EventBatch batch;
+    for (int i = 1; i <= 3; i++)
+    {
+        batch.emplace_back(i, MakeEvent(&SimulatorBatchTestCase::Record, this, i));
+    }
+    Simulator::ScheduleBatchWithContext(MicroSeconds(10), batch);
+    Simulator::ScheduleWithContext(8, MicroSeconds(10), &SimulatorBatchTestCase::Record, this, 4);
+    Simulator::ScheduleWithContext(9, MicroSeconds(5), &SimulatorBatchTestCase::Record, this, 5);
+
+    // A batch interrupted by Simulator::Stop is resumed by the next Run
+    batch.clear();
+    batch.emplace_back(10, MakeEvent(&SimulatorBatchTestCase::Record, this, 6));
+    batch.emplace_back(11, MakeEvent([]() { Simulator::Stop(); }));
+    batch.emplace_back(12, MakeEvent(&SimulatorBatchTestCase::Record, this, 7));
+    Simulator::ScheduleBatchWithContext(MicroSeconds(20), batch);
+
+    Simulator::Run();
+    NS_TEST_ASSERT_MSG_EQ(m_values.size(), 7, "Unexpected number of executed events");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), MicroSeconds(20), "Stop did not interrupt the batch");
+    Simulator::Run();
+    NS_TEST_ASSERT_MSG_EQ(m_values.size(), 8, "Remaining batched event was not executed");
+
+    const std::vector<int> values{5, 0, 1, 2, 3, 4, 6, 7};
+    const std::vector<uint32_t> contexts{9, 7, 1, 2, 3, 8, 10, 12};
+    for (std::size_t i = 0; i < m_values.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_values[i], values[i], "Unexpected order of event " << i);
+        NS_TEST_EXPECT_MSG_EQ(m_contexts[i], contexts[i], "Unexpected context of event " << i);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_times[3], MicroSeconds(10), "Unexpected time of batched event");
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetEventCount(), 9, "Unexpected event count");
+
+    Simulator::Destroy();
+}
+
+#ifndef __WIN32__
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that forked replicas are reseeded and report their results.
+ */
+class SimulatorReplicasTestCase : public TestCase
+{
+  public:
+    SimulatorReplicasTestCase();
+    void DoRun() override;
+};
+
+SimulatorReplicasTestCase::SimulatorReplicasTestCase()
+    : TestCase("Check that forked replicas are reseeded and report their results")
+{
+}
+
+void
+SimulatorReplicasTestCase::DoRun()
+{
+    auto rv = CreateObject<UniformRandomVariable>();
+    rv->SetStream(1);
+    double first = rv->GetValue();
+    rv->GetValue();
+
+    uint32_t replica = Simulator::ForkReplicas(3, 2);
+    if (replica != 0)
+    {
+        double value = 0;
+        Simulator::Schedule(Seconds(1), [&value, rv]() { value = rv->GetValue(); });
+        Simulator::Run();
+        Simulator::Destroy();
+        std::ostringstream oss;
+        oss << std::setprecision(17) << value;
+        Simulator::ExitReplica(oss.str());
+    }
+
+    std::vector<std::string> results = Simulator::GetReplicaResults();
+    NS_TEST_ASSERT_MSG_EQ(results.size(), 3, "Unexpected number of results");
+    std::ostringstream oss;
+    oss << std::setprecision(17) << first;
+    NS_TEST_EXPECT_MSG_EQ(results[0], oss.str(), "First replica should restart the current run");
+    NS_TEST_EXPECT_MSG_NE(results[1], results[0], "Replicas should use distinct runs");
+    NS_TEST_EXPECT_MSG_NE(results[2], results[1], "Replicas should use distinct runs");
+    NS_TEST_EXPECT_MSG_EQ(results[2].empty(), false, "Missing replica result");
+
+    Simulator::Destroy();
+}
+#endif
+
 /**
  * @ingroup simulator-tests
  *
@@ -718,14 +858,22 @@ class SimulatorTestSuite : public TestSuite
         factory.SetTypeId(ListScheduler::GetTypeId());
 
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorBatchTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(MapScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorBatchTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(HeapScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorBatchTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(CalendarScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorBatchTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        AddTestCase(new SimulatorBatchTestCase(factory), TestCase::Duration::QUICK);
+#ifndef __WIN32__
+        AddTestCase(new SimulatorReplicasTestCase, TestCase::Duration::QUICK);
+#endif
     }
 };
 